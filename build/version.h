@@ -0,0 +1,2 @@
+#define BEAK_VERSION "tag"
+#define BEAK_COMMIT "hash"